@@ -0,0 +1,196 @@
+#define MLQ_BUILD
+#include "mlq.h"
+#include "mlq_core.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <new>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+struct mlq_workload {
+    size_t count;
+    const int* arrival;
+    const int* burst;
+    const int* priority;
+    mlq_config config;
+
+    // Caller-owned result buffers, any may be null
+    int* start;
+    int* completion;
+    int* turnaround;
+    int* waiting;
+
+    MLQScheduler scheduler;  // used by mlq_run, keeps its memory between runs
+};
+
+namespace {
+
+bool validConfig(const mlq_config& config) {
+    if (config.time_quantum < 1) return false;
+    for (int q = 0; q < 4; q++) {
+        if (config.sequence[q] < MLQ_FCFS || config.sequence[q] > MLQ_ROUND_ROBIN) return false;
+    }
+    return true;
+}
+
+// Every time, turnaround and waiting value of a run must fit in an int.
+// The run ends by the latest arrival plus the total work (at least one unit
+// per process), which bounds all of them. Checked per run because the input
+// arrays are borrowed and may change between runs.
+bool fitsInInt(const mlq_workload& w) {
+    long long max_arrival = 0, min_arrival = 0, min_burst = 0, total_work = 0;
+    for (size_t i = 0; i < w.count; i++) {
+        max_arrival = max(max_arrival, (long long)w.arrival[i]);
+        min_arrival = min(min_arrival, (long long)w.arrival[i]);
+        min_burst = min(min_burst, (long long)w.burst[i]);
+        total_work += max(1, w.burst[i]);
+    }
+    return max_arrival + total_work - min_arrival - min_burst <= INT_MAX;
+}
+
+// Runs one configuration and writes results into any non-null buffers
+void runConfig(MLQScheduler& scheduler, const mlq_workload& w, const mlq_config& config,
+               int* start, int* completion, int* turnaround, int* waiting, mlq_summary* summary) {
+    scheduler.reset(w.arrival, w.burst, w.priority, w.count, config.sequence, config.time_quantum);
+    scheduler.run();
+
+    double total_turnaround = 0;
+    double total_waiting = 0;
+    int makespan = 0;
+    for (size_t i = 0; i < w.count; i++) {
+        int ct = scheduler.completionTime((int)i);
+        int tat = ct - w.arrival[i];
+        int wt = tat - w.burst[i];
+        if (start) start[i] = scheduler.startTime((int)i);
+        if (completion) completion[i] = ct;
+        if (turnaround) turnaround[i] = tat;
+        if (waiting) waiting[i] = wt;
+        total_turnaround += tat;
+        total_waiting += wt;
+        makespan = max(makespan, ct);
+    }
+
+    if (summary) {
+        summary->avg_turnaround = w.count ? total_turnaround / w.count : 0.0;
+        summary->avg_waiting = w.count ? total_waiting / w.count : 0.0;
+        summary->makespan = makespan;
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int mlq_api_version(void) {
+    return MLQ_API_VERSION;
+}
+
+mlq_workload* mlq_workload_create(const int* arrival, const int* burst, const int* priority, size_t count) {
+    if (count > 0 && (!arrival || !burst || !priority)) return nullptr;
+    if (count > (size_t)INT_MAX) return nullptr;
+
+    mlq_workload* workload = new (nothrow) mlq_workload();
+    if (!workload) return nullptr;
+
+    workload->count = count;
+    workload->arrival = arrival;
+    workload->burst = burst;
+    workload->priority = priority;
+    for (int q = 0; q < 4; q++) {
+        workload->config.sequence[q] = q;
+    }
+    workload->config.time_quantum = 2;
+    return workload;
+}
+
+void mlq_workload_destroy(mlq_workload* workload) {
+    delete workload;
+}
+
+int mlq_set_sequence(mlq_workload* workload, const int sequence[4]) {
+    if (!workload || !sequence) return MLQ_ERROR_INVALID_ARGUMENT;
+
+    mlq_config config = workload->config;
+    for (int q = 0; q < 4; q++) {
+        config.sequence[q] = sequence[q];
+    }
+    if (!validConfig(config)) return MLQ_ERROR_INVALID_ARGUMENT;
+
+    workload->config = config;
+    return MLQ_OK;
+}
+
+int mlq_set_time_quantum(mlq_workload* workload, int time_quantum) {
+    if (!workload || time_quantum < 1) return MLQ_ERROR_INVALID_ARGUMENT;
+    workload->config.time_quantum = time_quantum;
+    return MLQ_OK;
+}
+
+int mlq_set_result_buffers(mlq_workload* workload, int* start, int* completion, int* turnaround, int* waiting) {
+    if (!workload) return MLQ_ERROR_INVALID_ARGUMENT;
+    workload->start = start;
+    workload->completion = completion;
+    workload->turnaround = turnaround;
+    workload->waiting = waiting;
+    return MLQ_OK;
+}
+
+int mlq_run(mlq_workload* workload, mlq_summary* summary) {
+    if (!workload || !fitsInInt(*workload)) return MLQ_ERROR_INVALID_ARGUMENT;
+
+    try {
+        runConfig(workload->scheduler, *workload, workload->config, workload->start,
+                  workload->completion, workload->turnaround, workload->waiting, summary);
+    } catch (const bad_alloc&) {
+        return MLQ_ERROR_OUT_OF_MEMORY;
+    }
+    return MLQ_OK;
+}
+
+int mlq_run_batch(const mlq_workload* workload, const mlq_config* configs, size_t count,
+                  mlq_summary* summaries, int threads) {
+    if (!workload || threads < 0 || (count > 0 && (!configs || !summaries))) return MLQ_ERROR_INVALID_ARGUMENT;
+    for (size_t i = 0; i < count; i++) {
+        if (!validConfig(configs[i])) return MLQ_ERROR_INVALID_ARGUMENT;
+    }
+    if (!fitsInInt(*workload)) return MLQ_ERROR_INVALID_ARGUMENT;
+
+    size_t worker_count = threads > 0 ? (size_t)threads : max(1u, thread::hardware_concurrency());
+    worker_count = min(worker_count, count);
+
+    atomic<size_t> next(0);
+    atomic<bool> out_of_memory(false);
+
+    // Each worker keeps its own scheduler state and pulls configurations until none remain
+    auto work = [&]() {
+        try {
+            MLQScheduler scheduler;
+            for (size_t i = next++; i < count; i = next++) {
+                runConfig(scheduler, *workload, configs[i], nullptr, nullptr, nullptr, nullptr, &summaries[i]);
+            }
+        } catch (const bad_alloc&) {
+            out_of_memory = true;
+        }
+    };
+
+    // If a thread cannot be started, the ones already running share the work
+    vector<thread> workers;
+    try {
+        for (size_t t = 1; t < worker_count; t++) {
+            workers.emplace_back(work);
+        }
+    } catch (const exception&) {
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    return out_of_memory ? MLQ_ERROR_OUT_OF_MEMORY : MLQ_OK;
+}
+
+}
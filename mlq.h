@@ -0,0 +1,103 @@
+#ifndef MLQ_H
+#define MLQ_H
+
+/*
+ * Multilevel queue scheduler core with a C interface.
+ *
+ * Runs the same scheduling core as sch (mlq_core.h): 4 queues, process i
+ * goes to queue i % 4, queue 0 has the highest priority, and each queue runs
+ * the algorithm given by its sequence entry (0 FCFS, 1 Priority, 2 SJF,
+ * 3 Round Robin).
+ *
+ * A workload borrows the caller's input arrays instead of copying them, and
+ * each run writes its results into caller-bound buffers. The arrays must
+ * stay alive for as long as the workload is used.
+ */
+
+#include <stddef.h>
+
+#if defined(_WIN32)
+    #if defined(MLQ_BUILD)
+        #define MLQ_API __declspec(dllexport)
+    #else
+        #define MLQ_API __declspec(dllimport)
+    #endif
+#else
+    #define MLQ_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MLQ_API_VERSION 1
+
+enum {
+    MLQ_OK = 0,
+    MLQ_ERROR_INVALID_ARGUMENT = -1,
+    MLQ_ERROR_OUT_OF_MEMORY = -2
+};
+
+enum {
+    MLQ_FCFS = 0,
+    MLQ_PRIORITY = 1,
+    MLQ_SJF = 2,
+    MLQ_ROUND_ROBIN = 3
+};
+
+typedef struct mlq_workload mlq_workload;
+
+typedef struct mlq_config {
+    int sequence[4];    /* algorithm for each queue */
+    int time_quantum;   /* Round Robin time slice, at least 1 */
+} mlq_config;
+
+typedef struct mlq_summary {
+    double avg_turnaround;
+    double avg_waiting;
+    int makespan;       /* completion time of the last process */
+} mlq_summary;
+
+/* Returns MLQ_API_VERSION the library was built with. */
+MLQ_API int mlq_api_version(void);
+
+/* Creates a workload over count processes. The arrays are borrowed, not
+ * copied. Defaults to sequence {0, 1, 2, 3} and a time quantum of 2.
+ * Returns NULL on invalid arguments (including count > INT_MAX) or
+ * allocation failure. */
+MLQ_API mlq_workload* mlq_workload_create(const int* arrival, const int* burst,
+                                          const int* priority, size_t count);
+
+MLQ_API void mlq_workload_destroy(mlq_workload* workload);
+
+MLQ_API int mlq_set_sequence(mlq_workload* workload, const int sequence[4]);
+
+/* Returns MLQ_ERROR_INVALID_ARGUMENT for time_quantum < 1. */
+MLQ_API int mlq_set_time_quantum(mlq_workload* workload, int time_quantum);
+
+/* Binds per-process output buffers of count elements each. Any of them may
+ * be NULL. mlq_run writes results into them directly. */
+MLQ_API int mlq_set_result_buffers(mlq_workload* workload, int* start, int* completion,
+                                   int* turnaround, int* waiting);
+
+/* Runs the current configuration and fills the bound buffers.
+ * summary may be NULL. Working memory is kept in the workload and reused
+ * by the next run, so mlq_run is not reentrant on the same workload.
+ * Returns MLQ_ERROR_INVALID_ARGUMENT if completion, turnaround or waiting
+ * times could exceed INT_MAX. */
+MLQ_API int mlq_run(mlq_workload* workload, mlq_summary* summary);
+
+/* Evaluates count configurations against the same workload and writes one
+ * summary per configuration. Bound result buffers are not touched. Uses up
+ * to threads worker threads (0 picks the hardware concurrency, negative
+ * values are invalid), each with
+ * its own working memory, so it is safe to call concurrently on the same
+ * workload. Fails like mlq_run, or if any configuration is invalid. */
+MLQ_API int mlq_run_batch(const mlq_workload* workload, const mlq_config* configs,
+                          size_t count, mlq_summary* summaries, int threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,159 @@
+#include "mlq_core.h"
+
+#include <algorithm>
+
+using namespace std;
+
+MLQScheduler::MLQScheduler()
+    : arrival(nullptr), burst(nullptr), priority(nullptr), count(0), time_quantum(1),
+      next_pending(0), current_time(0), current_process(-1), current_queue(-1),
+      time_slice_remaining(0), finished_count(0) {
+    for (int q = 0; q < 4; q++) {
+        sequence[q] = q;
+    }
+}
+
+void MLQScheduler::reset(const int* arrival_times, const int* burst_times, const int* priorities,
+                         size_t process_count, const int queue_sequence[4], int quantum) {
+    arrival = arrival_times;
+    burst = burst_times;
+    priority = priorities;
+    count = process_count;
+    for (int q = 0; q < 4; q++) {
+        sequence[q] = queue_sequence[q];
+    }
+    time_quantum = quantum;
+
+    remaining.assign(burst, burst + count);
+    last_execution_time.assign(count, 0);
+    start.assign(count, 0);
+    completion.assign(count, 0);
+    has_started.assign(count, 0);
+    has_finished.assign(count, 0);
+
+    pending.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        pending[i] = (int)i;
+    }
+    const int* arrivals = arrival;
+    stable_sort(pending.begin(), pending.end(),
+                [arrivals](int a, int b) { return arrivals[a] < arrivals[b]; });
+    next_pending = 0;
+
+    for (int q = 0; q < 4; q++) {
+        ready[q].clear();
+    }
+
+    current_time = 0;
+    current_process = -1;
+    current_queue = -1;
+    time_slice_remaining = 0;
+    finished_count = 0;
+}
+
+// Strict order for picking from a ready queue; the first process wins ties
+bool MLQScheduler::before(int a, int b, int algorithm) const {
+    switch (algorithm) {
+        case FCFS:
+            if (arrival[a] != arrival[b]) return arrival[a] < arrival[b];
+            break;
+        case PRIORITY:
+            if (priority[a] != priority[b]) return priority[a] < priority[b];
+            if (arrival[a] != arrival[b]) return arrival[a] < arrival[b];
+            break;
+        case SJF:
+            if (remaining[a] != remaining[b]) return remaining[a] < remaining[b];
+            if (arrival[a] != arrival[b]) return arrival[a] < arrival[b];
+            break;
+        default: // Round Robin, least recently executed first
+            if (last_execution_time[a] != last_execution_time[b]) {
+                return last_execution_time[a] < last_execution_time[b];
+            }
+            if (arrival[a] != arrival[b]) return arrival[a] < arrival[b];
+            break;
+    }
+    return a < b;
+}
+
+void MLQScheduler::pushReady(int p) {
+    int q = p % 4;
+    ready[q].push_back(p);
+    push_heap(ready[q].begin(), ready[q].end(), Later{this, sequence[q]});
+}
+
+int MLQScheduler::popReady(int q) {
+    pop_heap(ready[q].begin(), ready[q].end(), Later{this, sequence[q]});
+    int p = ready[q].back();
+    ready[q].pop_back();
+    return p;
+}
+
+void MLQScheduler::admitArrivals() {
+    while (next_pending < pending.size() && arrival[pending[next_pending]] <= current_time) {
+        pushReady(pending[next_pending++]);
+    }
+}
+
+void MLQScheduler::executeProcess(int p, int algorithm) {
+    if (!has_started[p]) {
+        has_started[p] = 1;
+        start[p] = current_time;
+    }
+
+    last_execution_time[p] = current_time;
+    remaining[p] -= 1;
+
+    if (algorithm == ROUND_ROBIN && time_slice_remaining > 0) {
+        time_slice_remaining--;
+    }
+
+    if (remaining[p] <= 0) {
+        has_finished[p] = 1;
+        completion[p] = current_time + 1;
+        finished_count++;
+        current_process = -1;
+        current_queue = -1;
+    } else if (algorithm == ROUND_ROBIN && time_slice_remaining <= 0) {
+        // Time slice exhausted, back into the ready queue with its new last run time
+        pushReady(p);
+        current_process = -1;
+        current_queue = -1;
+    }
+}
+
+int MLQScheduler::step() {
+    admitArrivals();
+
+    int executed = -1;
+
+    // The running process keeps the CPU until it finishes or its time slice ends
+    if (current_process >= 0) {
+        executed = current_process;
+        executeProcess(executed, sequence[current_queue]);
+    } else {
+        // Queues in order of priority, queue 0 first
+        for (int q = 0; q < 4; q++) {
+            if (ready[q].empty()) continue;
+
+            executed = popReady(q);
+            current_process = executed;
+            current_queue = q;
+            if (sequence[q] == ROUND_ROBIN) {
+                time_slice_remaining = time_quantum;
+            }
+            executeProcess(executed, sequence[q]);
+            break;
+        }
+    }
+
+    current_time++;
+    return executed;
+}
+
+void MLQScheduler::run() {
+    while (!done()) {
+        if (step() < 0 && next_pending < pending.size()) {
+            current_time = max(current_time, arrival[pending[next_pending]]);
+        }
+    }
+}
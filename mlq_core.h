@@ -0,0 +1,85 @@
+#ifndef MLQ_CORE_H
+#define MLQ_CORE_H
+
+#include <cstddef>
+#include <vector>
+
+// Multilevel queue scheduling rules, shared by sch and libmlq. No SFML.
+//
+// Process i belongs to queue i % 4 and queue 0 has the highest priority.
+// Each queue runs the algorithm in its sequence entry. FCFS, Priority and
+// SJF keep a selected process until it finishes; Round Robin gives the CPU
+// up after time_quantum units. Ready processes wait in one heap per queue,
+// ordered by that queue's key, with ties going to the lower index.
+class MLQScheduler {
+public:
+    enum Algorithm { FCFS = 0, PRIORITY = 1, SJF = 2, ROUND_ROBIN = 3 };
+
+    MLQScheduler();
+
+    // Starts a new run. The input arrays are borrowed and must stay alive
+    // until the run is over. Memory from earlier runs is reused.
+    // sequence entries must be 0-3 and time_quantum at least 1.
+    void reset(const int* arrival, const int* burst, const int* priority, size_t count,
+               const int sequence[4], int time_quantum);
+
+    // Advances one time unit. Returns the process that ran, or -1 if none was ready.
+    int step();
+
+    // Runs until every process has finished, skipping idle time up to the next arrival
+    void run();
+
+    bool done() const { return finished_count == count; }
+    int currentTime() const { return current_time; }
+
+    // Process that keeps the CPU on the next step, -1 if the next step selects again
+    int currentProcess() const { return current_process; }
+    int currentQueue() const { return current_queue; }
+    int timeSliceRemaining() const { return time_slice_remaining; }
+
+    int remainingTime(int p) const { return remaining[p]; }
+    int lastExecutionTime(int p) const { return last_execution_time[p]; }
+    int startTime(int p) const { return start[p]; }
+    int completionTime(int p) const { return completion[p]; }
+    bool started(int p) const { return has_started[p] != 0; }
+    bool finished(int p) const { return has_finished[p] != 0; }
+
+private:
+    struct Later {
+        const MLQScheduler* scheduler;
+        int algorithm;
+        bool operator()(int a, int b) const { return scheduler->before(b, a, algorithm); }
+    };
+
+    const int* arrival;
+    const int* burst;
+    const int* priority;
+    size_t count;
+    int sequence[4];
+    int time_quantum;
+
+    std::vector<int> remaining;
+    std::vector<int> last_execution_time;
+    std::vector<int> start;
+    std::vector<int> completion;
+    std::vector<char> has_started;
+    std::vector<char> has_finished;
+
+    std::vector<int> pending;   // all processes by arrival, admitted from next_pending on
+    size_t next_pending;
+    std::vector<int> ready[4];  // heaps of arrived, unfinished processes not holding the CPU
+
+    int current_time;
+    int current_process;
+    int current_queue;
+    int time_slice_remaining;
+    size_t finished_count;
+
+    bool before(int a, int b, int algorithm) const;
+    void pushReady(int p);
+    int popReady(int q);
+    void admitArrivals();
+    void executeProcess(int p, int algorithm);
+};
+
+#endif
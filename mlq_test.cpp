@@ -0,0 +1,217 @@
+// Unit tests for libmlq. Run with `make -f MakeFile check`.
+
+#include "mlq.h"
+
+#include <climits>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+static int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            cout << __FILE__ << ":" << __LINE__ << ": failed: " #condition "\n"; \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+struct Result {
+    vector<int> start, completion, turnaround, waiting;
+    mlq_summary summary;
+    int status;
+};
+
+Result runOnce(const vector<int>& arrival, const vector<int>& burst, const vector<int>& priority,
+               const int sequence[4], int time_quantum) {
+    size_t n = arrival.size();
+    Result r;
+    r.start.assign(n, -1);
+    r.completion.assign(n, -1);
+    r.turnaround.assign(n, -1);
+    r.waiting.assign(n, -1);
+
+    mlq_workload* w = mlq_workload_create(arrival.data(), burst.data(), priority.data(), n);
+    r.status = w ? MLQ_OK : MLQ_ERROR_INVALID_ARGUMENT;
+    if (w) {
+        if (r.status == MLQ_OK) r.status = mlq_set_sequence(w, sequence);
+        if (r.status == MLQ_OK) r.status = mlq_set_time_quantum(w, time_quantum);
+        if (r.status == MLQ_OK) r.status = mlq_set_result_buffers(w, r.start.data(), r.completion.data(),
+                                                                    r.turnaround.data(), r.waiting.data());
+        if (r.status == MLQ_OK) r.status = mlq_run(w, &r.summary);
+        mlq_workload_destroy(w);
+    }
+    return r;
+}
+
+// The sample workload from README/data.txt, with the results sch prints for it
+void testSampleWorkload() {
+    vector<int> arrival = {0, 1, 3, 8, 9};
+    vector<int> burst = {14, 9, 6, 24, 5};
+    vector<int> priority = {2, 4, 3, 5, 1};
+    int sequence[4] = {1, 3, 2, 0};
+
+    Result r = runOnce(arrival, burst, priority, sequence, 4);
+    CHECK(r.status == MLQ_OK);
+    CHECK(r.start == vector<int>({0, 19, 28, 34, 14}));
+    CHECK(r.completion == vector<int>({14, 28, 34, 58, 19}));
+    CHECK(r.turnaround == vector<int>({14, 27, 31, 50, 10}));
+    CHECK(r.waiting == vector<int>({0, 18, 25, 26, 5}));
+    CHECK(r.summary.makespan == 58);
+    CHECK(r.summary.avg_turnaround == 26.4);
+    CHECK(r.summary.avg_waiting == 14.8);
+}
+
+// Processes 0 and 4 share queue 0; the other queues hold one unit of work each
+void testQueueOrdering() {
+    vector<int> arrival = {0, 0, 0, 0, 0};
+    vector<int> priority = {5, 0, 0, 0, 1};
+
+    // Round Robin: 0 and 4 alternate in slices of 2, least recently run first
+    int round_robin[4] = {3, 3, 3, 3};
+    Result r = runOnce(arrival, {3, 1, 1, 1, 3}, priority, round_robin, 2);
+    CHECK(r.status == MLQ_OK);
+    CHECK(r.start == vector<int>({0, 6, 7, 8, 2}));
+    CHECK(r.completion == vector<int>({5, 7, 8, 9, 6}));
+
+    // Priority: 4 has the better priority and runs to completion first
+    int by_priority[4] = {1, 0, 0, 0};
+    r = runOnce(arrival, {2, 1, 1, 1, 1}, priority, by_priority, 2);
+    CHECK(r.completion == vector<int>({3, 4, 5, 6, 1}));
+
+    // SJF: 4 is shorter
+    int shortest_first[4] = {2, 0, 0, 0};
+    r = runOnce(arrival, {4, 1, 1, 1, 2}, priority, shortest_first, 2);
+    CHECK(r.completion == vector<int>({6, 7, 8, 9, 2}));
+
+    // FCFS: equal arrivals go by index, and idle time is skipped to the next arrival
+    int first_come[4] = {0, 0, 0, 0};
+    r = runOnce({10, 10, 10, 10, 10}, {4, 1, 1, 1, 2}, priority, first_come, 2);
+    CHECK(r.start == vector<int>({10, 16, 17, 18, 14}));
+    CHECK(r.completion == vector<int>({14, 17, 18, 19, 16}));
+}
+
+void testEmptyWorkload() {
+    mlq_workload* w = mlq_workload_create(nullptr, nullptr, nullptr, 0);
+    CHECK(w != nullptr);
+    mlq_summary summary;
+    CHECK(mlq_run(w, &summary) == MLQ_OK);
+    CHECK(summary.makespan == 0);
+    CHECK(summary.avg_turnaround == 0.0);
+    mlq_workload_destroy(w);
+}
+
+// Batch summaries must match single runs, for any number of threads,
+// and repeated runs on one workload must give the same results
+void testBatchMatchesSingleRuns() {
+    mt19937 rng(2024);
+    auto uniform = [&rng](int lo, int hi) { return uniform_int_distribution<int>(lo, hi)(rng); };
+
+    for (int t = 0; t < 20; t++) {
+        int n = uniform(1, 500);
+        vector<int> arrival(n), burst(n), priority(n);
+        for (int i = 0; i < n; i++) {
+            arrival[i] = uniform(0, 3 * n);
+            burst[i] = uniform(0, 12);
+            priority[i] = uniform(0, 6);
+        }
+
+        vector<mlq_config> configs;
+        for (int algorithm = 0; algorithm < 4; algorithm++) {
+            configs.push_back({{algorithm, algorithm, algorithm, algorithm}, uniform(1, 5)});
+        }
+        for (int c = 0; c < 12; c++) {
+            configs.push_back({{uniform(0, 3), uniform(0, 3), uniform(0, 3), uniform(0, 3)}, uniform(1, 5)});
+        }
+
+        mlq_workload* w = mlq_workload_create(arrival.data(), burst.data(), priority.data(), n);
+        CHECK(w != nullptr);
+
+        vector<mlq_summary> expected(configs.size());
+        vector<int> completion(n), first_completion(n);
+        CHECK(mlq_set_result_buffers(w, nullptr, completion.data(), nullptr, nullptr) == MLQ_OK);
+        for (size_t c = 0; c < configs.size(); c++) {
+            CHECK(mlq_set_sequence(w, configs[c].sequence) == MLQ_OK);
+            CHECK(mlq_set_time_quantum(w, configs[c].time_quantum) == MLQ_OK);
+            CHECK(mlq_run(w, &expected[c]) == MLQ_OK);
+            if (c == 0) first_completion = completion;
+        }
+
+        CHECK(mlq_set_sequence(w, configs[0].sequence) == MLQ_OK);
+        CHECK(mlq_set_time_quantum(w, configs[0].time_quantum) == MLQ_OK);
+        CHECK(mlq_run(w, nullptr) == MLQ_OK);
+        CHECK(completion == first_completion);
+
+        for (int threads : {1, 3, 0}) {
+            vector<mlq_summary> summaries(configs.size());
+            CHECK(mlq_run_batch(w, configs.data(), configs.size(), summaries.data(), threads) == MLQ_OK);
+            for (size_t c = 0; c < configs.size(); c++) {
+                CHECK(summaries[c].avg_turnaround == expected[c].avg_turnaround);
+                CHECK(summaries[c].avg_waiting == expected[c].avg_waiting);
+                CHECK(summaries[c].makespan == expected[c].makespan);
+            }
+        }
+
+        mlq_workload_destroy(w);
+    }
+}
+
+void testInvalidArguments() {
+    int arrival[2] = {0, 1};
+    int burst[2] = {3, 2};
+    int priority[2] = {1, 1};
+    mlq_summary summary;
+
+    CHECK(mlq_workload_create(nullptr, burst, priority, 2) == nullptr);
+    CHECK(mlq_workload_create(arrival, burst, priority, (size_t)INT_MAX + 1) == nullptr);
+    CHECK(mlq_run(nullptr, &summary) == MLQ_ERROR_INVALID_ARGUMENT);
+
+    mlq_workload* w = mlq_workload_create(arrival, burst, priority, 2);
+    CHECK(w != nullptr);
+
+    int bad_high[4] = {0, 1, 2, 4};
+    int bad_low[4] = {-1, 1, 2, 3};
+    CHECK(mlq_set_sequence(w, bad_high) == MLQ_ERROR_INVALID_ARGUMENT);
+    CHECK(mlq_set_sequence(w, bad_low) == MLQ_ERROR_INVALID_ARGUMENT);
+    CHECK(mlq_set_sequence(w, nullptr) == MLQ_ERROR_INVALID_ARGUMENT);
+    CHECK(mlq_set_time_quantum(w, 0) == MLQ_ERROR_INVALID_ARGUMENT);
+    CHECK(mlq_set_time_quantum(w, -3) == MLQ_ERROR_INVALID_ARGUMENT);
+
+    mlq_config good = {{0, 1, 2, 3}, 2};
+    mlq_config zero_quantum = {{0, 1, 2, 3}, 0};
+    mlq_config bad_sequence = {{0, 1, 2, 7}, 2};
+    mlq_config mixed[2] = {good, bad_sequence};
+    mlq_summary summaries[2];
+    CHECK(mlq_run_batch(w, &zero_quantum, 1, summaries, 1) == MLQ_ERROR_INVALID_ARGUMENT);
+    CHECK(mlq_run_batch(w, mixed, 2, summaries, 2) == MLQ_ERROR_INVALID_ARGUMENT);
+    CHECK(mlq_run_batch(w, &good, 1, summaries, -1) == MLQ_ERROR_INVALID_ARGUMENT);
+    CHECK(mlq_run_batch(w, &good, 1, nullptr, 1) == MLQ_ERROR_INVALID_ARGUMENT);
+    CHECK(mlq_run_batch(w, &good, 1, summaries, 1) == MLQ_OK);
+
+    // Inputs are borrowed, so a later change that would overflow int is caught per run
+    arrival[1] = INT_MAX - 3;
+    CHECK(mlq_run(w, &summary) == MLQ_ERROR_INVALID_ARGUMENT);
+    CHECK(mlq_run_batch(w, &good, 1, summaries, 1) == MLQ_ERROR_INVALID_ARGUMENT);
+    arrival[1] = 1;
+    CHECK(mlq_run(w, &summary) == MLQ_OK);
+
+    mlq_workload_destroy(w);
+}
+
+int main() {
+    CHECK(mlq_api_version() == MLQ_API_VERSION);
+
+    testSampleWorkload();
+    testQueueOrdering();
+    testEmptyWorkload();
+    testBatchMatchesSingleRuns();
+    testInvalidArguments();
+
+    cout << (failures ? "FAILED" : "OK") << ": mlq_test";
+    if (failures) cout << " (" << failures << " checks failed)";
+    cout << "\n";
+    return failures ? 1 : 0;
+}
@@ -1,4 +1,5 @@
 #include <SFML/Graphics.hpp>
+#include "mlq_core.h"
 #include <iostream>
 #include <algorithm>
 #include <climits>
@@ -7,6 +8,13 @@
 #include <sstream>
 #include <iomanip>
 #include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 using namespace std;
 
@@ -32,6 +40,287 @@ struct SimulationData {
     int time_quantum;
 };
 
+// Writes per-process results and per-queue summaries in bulk.
+// Rows are formatted by hand into a large buffer and written in big chunks,
+// so exporting millions of processes is not bound by stream formatting or flushes.
+class ResultExporter {
+private:
+    ofstream file;
+    vector<char> buffer;
+    size_t used;
+
+    static const size_t BUFFER_SIZE = 1 << 20;
+    static const size_t MAX_ROW = 512;
+
+public:
+    enum Format { NONE, CSV, JSONL };
+
+    static Format parseFormat(const string& name) {
+        if (name == "csv") return CSV;
+        if (name == "jsonl" || name == "json") return JSONL;
+        return NONE;
+    }
+
+    static string defaultPath(Format format) {
+        return format == JSONL ? "results.jsonl" : "results.csv";
+    }
+
+    ResultExporter() : buffer(BUFFER_SIZE), used(0) {}
+
+    ~ResultExporter() {
+        close();
+    }
+
+    bool open(const string& filename) {
+        file.open(filename, ios::out | ios::binary | ios::trunc);
+        used = 0;
+        return file.is_open();
+    }
+
+    // Returns false if any write since open() failed, e.g. on a full disk
+    bool close() {
+        if (!file.is_open()) return true;
+        bool ok = flush();
+        file.close();
+        return ok && !file.fail();
+    }
+
+    bool flush() {
+        if (used > 0) {
+            file.write(buffer.data(), used);
+            used = 0;
+        }
+        return !file.fail();
+    }
+
+    // Make sure at least one full row fits before formatting it
+    void reserveRow() {
+        if (BUFFER_SIZE - used < MAX_ROW) flush();
+    }
+
+    void put(char c) {
+        buffer[used++] = c;
+    }
+
+    void put(const char* s) {
+        while (*s) buffer[used++] = *s++;
+    }
+
+    void putInt(long long value) {
+        char digits[24];
+        int n = 0;
+        unsigned long long v = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+        do {
+            digits[n++] = char('0' + v % 10);
+            v /= 10;
+        } while (v > 0);
+        if (value < 0) buffer[used++] = '-';
+        while (n > 0) buffer[used++] = digits[--n];
+    }
+
+    // Fixed two decimals, matching the precision shown in the UI
+    void putFixed2(double value) {
+        long long scaled = (long long)(value * 100.0 + (value < 0 ? -0.5 : 0.5));
+        if (scaled < 0) {
+            buffer[used++] = '-';
+            scaled = -scaled;
+        }
+        putInt(scaled / 100);
+        buffer[used++] = '.';
+        buffer[used++] = char('0' + (scaled / 10) % 10);
+        buffer[used++] = char('0' + scaled % 10);
+    }
+
+    static bool exportResults(const vector<Process>& processes, const vector<int>& sequence,
+                              const vector<string>& algorithm_names, Format format, const string& filename) {
+        if (format == NONE) return false;
+
+        // Per-queue aggregates
+        int queue_count = sequence.size();
+        vector<long long> count(queue_count, 0), total_burst(queue_count, 0);
+        vector<long long> total_tat(queue_count, 0), total_wt(queue_count, 0), last_ct(queue_count, 0);
+        for (const auto& process : processes) {
+            int q = process.queue_index;
+            if (q < 0 || q >= queue_count) continue;
+            count[q]++;
+            total_burst[q] += process.burst_time;
+            total_tat[q] += process.turnaround_time;
+            total_wt[q] += process.waiting_time;
+            last_ct[q] = max(last_ct[q], (long long)process.completion_time);
+        }
+
+        ResultExporter out;
+        if (!out.open(filename)) {
+            cout << "Error: Could not open file for writing: " << filename << "\n";
+            return false;
+        }
+
+        if (format == CSV) {
+            out.put("pid,queue,algorithm,arrival,burst,priority,start,completion,turnaround,waiting\n");
+            for (const auto& process : processes) {
+                out.reserveRow();
+                out.putInt(process.pid); out.put(',');
+                out.putInt(process.queue_index + 1); out.put(',');
+                out.put(algorithm_names[sequence[process.queue_index]].c_str()); out.put(',');
+                out.putInt(process.arrival_time); out.put(',');
+                out.putInt(process.burst_time); out.put(',');
+                out.putInt(process.priority); out.put(',');
+                out.putInt(process.start_time); out.put(',');
+                out.putInt(process.completion_time); out.put(',');
+                out.putInt(process.turnaround_time); out.put(',');
+                out.putInt(process.waiting_time); out.put('\n');
+            }
+            if (!out.close()) {
+                cout << "Error: Could not write file: " << filename << "\n";
+                return false;
+            }
+
+            // Queue summaries go next to the process table, e.g. results_queues.csv
+            string queue_filename = filename;
+            size_t dot = queue_filename.find_last_of('.');
+            size_t slash = queue_filename.find_last_of("/\\");
+            if (dot == string::npos || (slash != string::npos && dot < slash)) dot = queue_filename.size();
+            queue_filename.insert(dot, "_queues");
+
+            if (!out.open(queue_filename)) {
+                cout << "Error: Could not open file for writing: " << queue_filename << "\n";
+                return false;
+            }
+            out.put("queue,algorithm,processes,total_burst,last_completion,avg_turnaround,avg_waiting\n");
+            for (int q = 0; q < queue_count; q++) {
+                out.reserveRow();
+                out.putInt(q + 1); out.put(',');
+                out.put(algorithm_names[sequence[q]].c_str()); out.put(',');
+                out.putInt(count[q]); out.put(',');
+                out.putInt(total_burst[q]); out.put(',');
+                out.putInt(last_ct[q]); out.put(',');
+                out.putFixed2(count[q] ? (double)total_tat[q] / count[q] : 0.0); out.put(',');
+                out.putFixed2(count[q] ? (double)total_wt[q] / count[q] : 0.0); out.put('\n');
+            }
+            if (!out.close()) {
+                cout << "Error: Could not write file: " << queue_filename << "\n";
+                return false;
+            }
+            cout << "Results exported to " << filename << " and " << queue_filename << "\n";
+        } else {
+            for (const auto& process : processes) {
+                out.reserveRow();
+                out.put("{\"type\":\"process\",\"pid\":"); out.putInt(process.pid);
+                out.put(",\"queue\":"); out.putInt(process.queue_index + 1);
+                out.put(",\"algorithm\":\""); out.put(algorithm_names[sequence[process.queue_index]].c_str());
+                out.put("\",\"arrival\":"); out.putInt(process.arrival_time);
+                out.put(",\"burst\":"); out.putInt(process.burst_time);
+                out.put(",\"priority\":"); out.putInt(process.priority);
+                out.put(",\"start\":"); out.putInt(process.start_time);
+                out.put(",\"completion\":"); out.putInt(process.completion_time);
+                out.put(",\"turnaround\":"); out.putInt(process.turnaround_time);
+                out.put(",\"waiting\":"); out.putInt(process.waiting_time);
+                out.put("}\n");
+            }
+            for (int q = 0; q < queue_count; q++) {
+                out.reserveRow();
+                out.put("{\"type\":\"queue\",\"queue\":"); out.putInt(q + 1);
+                out.put(",\"algorithm\":\""); out.put(algorithm_names[sequence[q]].c_str());
+                out.put("\",\"processes\":"); out.putInt(count[q]);
+                out.put(",\"total_burst\":"); out.putInt(total_burst[q]);
+                out.put(",\"last_completion\":"); out.putInt(last_ct[q]);
+                out.put(",\"avg_turnaround\":"); out.putFixed2(count[q] ? (double)total_tat[q] / count[q] : 0.0);
+                out.put(",\"avg_waiting\":"); out.putFixed2(count[q] ? (double)total_wt[q] / count[q] : 0.0);
+                out.put("}\n");
+            }
+            if (!out.close()) {
+                cout << "Error: Could not write file: " << filename << "\n";
+                return false;
+            }
+            cout << "Results exported to " << filename << "\n";
+        }
+        return true;
+    }
+};
+
+// Encodes rendered frames to image files on a pool of worker threads.
+// The queue is bounded so drawing cannot run arbitrarily far ahead of encoding.
+// Frames are held by pointer: sf::Image has no move constructor, so only the
+// pointer moves through the queue instead of a full pixel copy under the lock.
+class FrameWriter {
+private:
+    struct Job {
+        unique_ptr<sf::Image> image;
+        string filename;
+    };
+    
+    vector<thread> workers;
+    deque<Job> jobs;
+    mutex jobs_mutex;
+    condition_variable jobs_ready;
+    condition_variable jobs_space;
+    size_t max_jobs;
+    bool done;
+    int failed;
+    
+    void work() {
+        while (true) {
+            Job job;
+            {
+                unique_lock<mutex> lock(jobs_mutex);
+                jobs_ready.wait(lock, [this] { return done || !jobs.empty(); });
+                if (jobs.empty()) return;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            jobs_space.notify_one();
+            
+            if (!job.image->saveToFile(job.filename)) {
+                lock_guard<mutex> lock(jobs_mutex);
+                failed++;
+            }
+        }
+    }
+    
+public:
+    FrameWriter() : done(false), failed(0) {
+        unsigned count = max(1u, thread::hardware_concurrency());
+        max_jobs = count * 2;
+        for (unsigned i = 0; i < count; i++) {
+            workers.emplace_back(&FrameWriter::work, this);
+        }
+    }
+    
+    ~FrameWriter() {
+        finish();
+    }
+    
+    void push(unique_ptr<sf::Image> image, string filename) {
+        Job job;
+        job.image = std::move(image);
+        job.filename = std::move(filename);
+        
+        unique_lock<mutex> lock(jobs_mutex);
+        jobs_space.wait(lock, [this] { return jobs.size() < max_jobs; });
+        jobs.push_back(std::move(job));
+        lock.unlock();
+        jobs_ready.notify_one();
+    }
+    
+    // Wait for every queued frame to be written
+    void finish() {
+        {
+            lock_guard<mutex> lock(jobs_mutex);
+            done = true;
+        }
+        jobs_ready.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+    
+    int failures() {
+        lock_guard<mutex> lock(jobs_mutex);
+        return failed;
+    }
+};
+
 class MLQVisualizer {
 private:
     sf::RenderWindow window;
@@ -39,6 +328,11 @@ private:
     vector<Process> processes;
     vector<Process> original_processes; // Store original data
     vector<vector<Process*>> queues;
+    
+    // Scheduling runs in the shared core; processes mirror its state for drawing
+    MLQScheduler scheduler;
+    vector<int> arrival_times, burst_times, priorities;
+    int executed_process;
     vector<string> algorithm_names;
     vector<int> sequence;
     int time_quantum;
@@ -48,6 +342,15 @@ private:
     bool simulation_running;
     bool simulation_paused;
     bool simulation_completed;
+    bool headless;
+    
+    // Result export
+    ResultExporter::Format export_format;
+    string export_path;
+    bool export_failed;
+    
+    // File used by the S and L keys
+    string data_file;
     
     // Animation variables
     float animation_speed;
@@ -71,10 +374,10 @@ private:
     };
 
 public:
-    MLQVisualizer() : window(sf::VideoMode(1400, 900), "Multilevel Queue Scheduler Visualization"),
-                      queues(4), animation_speed(1.0f), current_time(0), current_executing_queue(-1),
+    MLQVisualizer() : queues(4), animation_speed(1.0f), current_time(0), current_executing_queue(-1),
                       current_executing_process(nullptr), simulation_running(false), 
-                      simulation_paused(false), simulation_completed(false) {
+                      simulation_paused(false), simulation_completed(false), headless(false),
+                      export_format(ResultExporter::NONE), export_failed(false), executed_process(-1) {
         
         // Try multiple font paths
         vector<string> font_paths = {
@@ -90,7 +393,7 @@ public:
         for (const string& path : font_paths) {
             if (font.loadFromFile(path)) {
                 font_loaded = true;
-                cout << "Loaded font: " << path << endl;
+                cout << "Loaded font: " << path << "\n";
                 break;
             }
         }
@@ -102,7 +405,19 @@ public:
         algorithm_names = {"FCFS", "Priority", "SJF", "Round Robin"};
         
         setupUI();
-        window.setFramerateLimit(60);
+    }
+    
+    void setSpeed(float speed) {
+        if (speed > 0) animation_speed = speed;
+    }
+    
+    void setDataFile(const string& filename) {
+        data_file = filename;
+    }
+    
+    void setExport(ResultExporter::Format format, const string& path) {
+        export_format = format;
+        export_path = path;
     }
     
     void setupUI() {
@@ -141,7 +456,7 @@ public:
     void saveToFile(const string& filename) {
         ofstream file(filename);
         if (!file.is_open()) {
-            cout << "Error: Could not open file for writing: " << filename << endl;
+            cout << "Error: Could not open file for writing: " << filename << "\n";
             return;
         }
         
@@ -159,19 +474,22 @@ public:
         file << "\n";
         
         file.close();
-        cout << "Data saved to " << filename << endl;
+        cout << "Data saved to " << filename << "\n";
     }
     
     bool loadFromFile(const string& filename) {
         ifstream file(filename);
         if (!file.is_open()) {
-            cout << "Error: Could not open file for reading: " << filename << endl;
+            cout << "Error: Could not open file for reading: " << filename << "\n";
             return false;
         }
         
-        int n;
-        file >> n;
-        file >> time_quantum;
+        int n = 0, quantum = 0;
+        file >> n >> quantum;
+        if (!file || n < 0 || quantum < 1) {
+            cout << "Error: Invalid process count or time quantum in " << filename << "\n";
+            return false;
+        }
         
         vector<Process> loaded_processes(n);
         for (int i = 0; i < n; i++) {
@@ -184,10 +502,21 @@ public:
             file >> loaded_sequence[i];
         }
         
+        if (!file) {
+            cout << "Error: Missing or malformed values in " << filename << "\n";
+            return false;
+        }
+        for (int algorithm : loaded_sequence) {
+            if (algorithm < 0 || algorithm > 3) {
+                cout << "Error: Queue sequence entries must be 0-3 in " << filename << "\n";
+                return false;
+            }
+        }
+        
         file.close();
         
-        initializeProcesses(loaded_processes, loaded_sequence, time_quantum);
-        cout << "Data loaded from " << filename << endl;
+        initializeProcesses(loaded_processes, loaded_sequence, quantum);
+        cout << "Data loaded from " << filename << "\n";
         return true;
     }
     
@@ -217,6 +546,15 @@ public:
             queues[queue_index].push_back(&processes[i]);
         }
         
+        arrival_times.clear();
+        burst_times.clear();
+        priorities.clear();
+        for (const auto& process : processes) {
+            arrival_times.push_back(process.arrival_time);
+            burst_times.push_back(process.burst_time);
+            priorities.push_back(process.priority);
+        }
+        
         positionProcesses();
         resetSimulation();
     }
@@ -238,10 +576,14 @@ public:
         current_time = 0;
         current_executing_queue = -1;
         current_executing_process = nullptr;
+        executed_process = -1;
         simulation_running = false;
         simulation_paused = false;
         simulation_completed = false;
         
+        scheduler.reset(arrival_times.data(), burst_times.data(), priorities.data(),
+                        processes.size(), sequence.data(), time_quantum);
+        
         for (auto& process : processes) {
             process.remaining_time = process.burst_time;
             process.finished = false;
@@ -263,173 +605,68 @@ public:
         
         if (simulation_clock.getElapsedTime().asMilliseconds() > (1000 / animation_speed)) {
             simulation_clock.restart();
-            
-            // Check if all processes are finished
-            bool all_finished = true;
-            for (const auto& process : processes) {
-                if (!process.finished) {
-                    all_finished = false;
-                    break;
-                }
-            }
-            
-            if (all_finished) {
-                simulation_completed = true;
-                calculateFinalStatistics();
-                return;
-            }
-            
-            // Execute scheduling
-            executeScheduling();
-            current_time++;
+            stepSimulation();
         }
     }
     
-    void executeScheduling() {
-        // Reset execution states
-        for (auto& process : processes) {
-            process.is_executing = false;
-            if (!process.finished) {
-                // Better positioning to prevent overlap
-                auto it = find(queues[process.queue_index].begin(), queues[process.queue_index].end(), &process);
-                int position_in_queue = it - queues[process.queue_index].begin();
-                process.target_position.x = 100 + position_in_queue * 55; // Increased spacing
-                process.target_position.y = 150 + process.queue_index * 100; // Queue positioning
-            }
+    // Advance the simulation by one time unit
+    void stepSimulation() {
+        if (scheduler.done()) {
+            simulation_completed = true;
+            calculateFinalStatistics();
+            return;
         }
         
-        // Check if current process should continue (for Round Robin or non-preemptive)
-        if (current_executing_process && !current_executing_process->finished) {
-            int current_algorithm = sequence[current_executing_queue];
-            
-            // For Round Robin, check if time slice is exhausted
-            if (current_algorithm == 3) { // Round Robin
-                if (current_executing_process->time_slice_remaining > 0) {
-                    executeProcess(current_executing_process, current_algorithm);
-                    return;
-                }
-            } else {
-                // For non-preemptive algorithms, continue until process finishes
-                executeProcess(current_executing_process, current_algorithm);
-                return;
-            }
+        // Execute scheduling
+        executeScheduling();
+        current_time = scheduler.currentTime();
+    }
+    
+    void executeScheduling() {
+        // Reset execution state of the process that ran last tick
+        if (executed_process >= 0) {
+            processes[executed_process].is_executing = false;
         }
         
-        // Find next process to execute (multilevel queue priority)
-        current_executing_process = nullptr;
-        current_executing_queue = -1;
-        
-        // Check queues in order of priority (Queue 0 has highest priority)
-        for (int q = 0; q < 4; q++) {
-            Process* selected = selectFromQueue(q);
-            if (selected) {
-                current_executing_process = selected;
-                current_executing_queue = q;
-                
-                // Initialize time slice for Round Robin
-                if (sequence[q] == 3) { // Round Robin
-                    current_executing_process->time_slice_remaining = time_quantum;
+        if (!headless) {
+            for (auto& process : processes) {
+                if (!process.finished) {
+                    // Better positioning to prevent overlap
+                    auto it = find(queues[process.queue_index].begin(), queues[process.queue_index].end(), &process);
+                    int position_in_queue = it - queues[process.queue_index].begin();
+                    process.target_position.x = 100 + position_in_queue * 55; // Increased spacing
+                    process.target_position.y = 150 + process.queue_index * 100; // Queue positioning
                 }
-                
-                executeProcess(current_executing_process, sequence[q]);
-                break;
             }
         }
-    }
-    
-    Process* selectFromQueue(int queue_index) {
-        vector<Process*>& current_queue_processes = queues[queue_index];
-        int algorithm = sequence[queue_index];
         
-        // Find ready processes
-        vector<Process*> ready_processes;
-        for (auto* process : current_queue_processes) {
-            if (process->arrival_time <= current_time && !process->finished) {
-                ready_processes.push_back(process);
-            }
-        }
+        executed_process = scheduler.step();
         
-        if (ready_processes.empty()) {
-            return nullptr;
-        }
+        current_executing_queue = scheduler.currentQueue();
+        current_executing_process = scheduler.currentProcess() >= 0 ? &processes[scheduler.currentProcess()] : nullptr;
         
-        return selectProcess(ready_processes, algorithm);
-    }
-    
-    Process* selectProcess(vector<Process*>& ready_processes, int algorithm) {
-        switch (algorithm) {
-            case 0: // FCFS
-                return *min_element(ready_processes.begin(), ready_processes.end(),
-                    [](Process* a, Process* b) { 
-                        if (a->arrival_time == b->arrival_time) {
-                            return a->pid < b->pid;
-                        }
-                        return a->arrival_time < b->arrival_time; 
-                    });
-                
-            case 1: // Priority Scheduling
-                return *min_element(ready_processes.begin(), ready_processes.end(),
-                    [](Process* a, Process* b) { 
-                        if (a->priority == b->priority) {
-                            return a->arrival_time < b->arrival_time;
-                        }
-                        return a->priority < b->priority; 
-                    });
-                
-            case 2: // SJF
-                return *min_element(ready_processes.begin(), ready_processes.end(),
-                    [](Process* a, Process* b) { 
-                        if (a->remaining_time == b->remaining_time) {
-                            return a->arrival_time < b->arrival_time;
-                        }
-                        return a->remaining_time < b->remaining_time; 
-                    });
-                
-            case 3: // Round Robin
-                // Find the process that was executed least recently
-                return *min_element(ready_processes.begin(), ready_processes.end(),
-                    [](Process* a, Process* b) { 
-                        if (a->last_execution_time == b->last_execution_time) {
-                            return a->arrival_time < b->arrival_time;
-                        }
-                        return a->last_execution_time < b->last_execution_time; 
-                    });
+        if (executed_process >= 0) {
+            Process& process = processes[executed_process];
+            syncProcess(process);
+            process.time_slice_remaining = scheduler.timeSliceRemaining();
+            process.is_executing = true;
+            process.target_position.x = 680 + (current_time % 4) * 60; // Stagger positions to prevent overlap
+            process.target_position.y = 200 + (current_time % 6) * 50;  // Vertical staggering too
         }
-        return nullptr;
     }
     
-    void executeProcess(Process* process, int algorithm) {
-        if (!process->started) {
-            process->started = true;
-            process->start_time = current_time;
-        }
-        
-        process->is_executing = true;
-        process->target_position.x = 680 + (current_time % 4) * 60; // Stagger positions to prevent overlap
-        process->target_position.y = 200 + (current_time % 6) * 50;  // Vertical staggering too
-        process->last_execution_time = current_time;
-        
-        // Execute for 1 time unit
-        process->remaining_time -= 1;
-        
-        // For Round Robin, decrease time slice
-        if (algorithm == 3 && process->time_slice_remaining > 0) {
-            process->time_slice_remaining--;
-        }
-        
-        if (process->remaining_time <= 0) {
-            process->finished = true;
-            process->completion_time = current_time + 1;
-            process->turnaround_time = process->completion_time - process->arrival_time;
-            process->waiting_time = process->turnaround_time - process->burst_time;
-            
-            // Clear current executing process
-            current_executing_process = nullptr;
-            current_executing_queue = -1;
-        } else if (algorithm == 3 && process->time_slice_remaining <= 0) {
-            // Time slice exhausted for Round Robin
-            current_executing_process = nullptr;
-            current_executing_queue = -1;
+    // Copy a process's scheduling state from the core
+    void syncProcess(Process& process) {
+        int p = process.pid - 1;
+        process.remaining_time = scheduler.remainingTime(p);
+        process.started = scheduler.started(p);
+        process.start_time = scheduler.startTime(p);
+        process.last_execution_time = scheduler.lastExecutionTime(p);
+        process.finished = scheduler.finished(p);
+        if (process.finished) {
+            process.completion_time = scheduler.completionTime(p);
+            process.turnaround_time = process.completion_time - process.arrival_time;
+            process.waiting_time = process.turnaround_time - process.burst_time;
         }
     }
     
@@ -452,24 +689,34 @@ public:
         averages_text.setString(avg_stream.str());
         
         cout << "\n=== SIMULATION COMPLETED ===\n";
-        cout << "PID\tAT\tBT\tPrio\tCT\tTAT\tWT\n";
-        for (const auto& process : processes) {
-            cout << process.pid << "\t" << process.arrival_time << "\t" << process.burst_time
-                 << "\t" << process.priority << "\t" << process.completion_time
-                 << "\t" << process.turnaround_time << "\t" << process.waiting_time << "\n";
+        if (export_format == ResultExporter::NONE) {
+            cout << "PID\tAT\tBT\tPrio\tCT\tTAT\tWT\n";
+            for (const auto& process : processes) {
+                cout << process.pid << "\t" << process.arrival_time << "\t" << process.burst_time
+                     << "\t" << process.priority << "\t" << process.completion_time
+                     << "\t" << process.turnaround_time << "\t" << process.waiting_time << "\n";
+            }
+        } else {
+            export_failed = !ResultExporter::exportResults(processes, sequence, algorithm_names,
+                                                           export_format, export_path);
         }
         cout << "\nAverage Turnaround Time: " << avg_turnaround << "\n";
         cout << "Average Waiting Time: " << avg_waiting << "\n";
     }
     
     void updateAnimations() {
-        float dt = animation_clock.restart().asSeconds();
+        advanceAnimations(animation_clock.restart().asSeconds());
+    }
+    
+    void advanceAnimations(float dt) {
+        // Never step past the target, even for long frames
+        float step = min(1.0f, 5.0f * dt);
         
         for (auto& process : processes) {
             // Smooth movement animation
             sf::Vector2f diff = process.target_position - process.position;
             if (abs(diff.x) > 1 || abs(diff.y) > 1) {
-                process.position += diff * 5.0f * dt;
+                process.position += diff * step;
             } else {
                 process.position = process.target_position;
             }
@@ -507,11 +754,11 @@ public:
                         break;
                         
                     case sf::Keyboard::S:
-                        saveToFile("data.txt");
+                        saveToFile(data_file);
                         break;
                         
                     case sf::Keyboard::L:
-                        loadFromFile("data.txt");
+                        loadFromFile(data_file);
                         break;
                         
                     case sf::Keyboard::Escape:
@@ -523,15 +770,20 @@ public:
     }
     
     void render() {
-        window.clear(sf::Color::Black);
+        draw(window);
+        window.display();
+    }
+    
+    void draw(sf::RenderTarget& target) {
+        target.clear(sf::Color::Black);
         
         // Draw UI
-        window.draw(title_text);
+        target.draw(title_text);
         
         stringstream time_stream;
         time_stream << "Time: " << current_time;
         time_text.setString(time_stream.str());
-        window.draw(time_text);
+        target.draw(time_text);
         
         stringstream status_stream;
         if (simulation_completed) {
@@ -550,10 +802,10 @@ public:
             status_stream << "Status: READY";
         }
         status_text.setString(status_stream.str());
-        window.draw(status_text);
+        target.draw(status_text);
         
-        window.draw(instructions_text);
-        window.draw(averages_text);
+        target.draw(instructions_text);
+        target.draw(averages_text);
         
         // Draw queue labels and backgrounds
         sf::RectangleShape queue_bg(sf::Vector2f(500, 80));
@@ -578,7 +830,7 @@ public:
             
             queue_bg.setOutlineThickness(1);
             queue_bg.setOutlineColor(sf::Color::White);
-            window.draw(queue_bg);
+            target.draw(queue_bg);
             
             stringstream label_stream;
             label_stream << "Queue " << i + 1 << " (Priority " << (i + 1) << "): " 
@@ -588,7 +840,7 @@ public:
             }
             queue_label.setString(label_stream.str());
             queue_label.setPosition(55, queue_y_positions[i] + 5);
-            window.draw(queue_label);
+            target.draw(queue_label);
         }
         
         // Draw execution area
@@ -597,7 +849,7 @@ public:
         exec_area.setFillColor(sf::Color(100, 0, 0, 50));
         exec_area.setOutlineThickness(2);
         exec_area.setOutlineColor(sf::Color::Red);
-        window.draw(exec_area);
+        target.draw(exec_area);
         
         sf::Text exec_label;
         if (font.getInfo().family != "") {
@@ -607,7 +859,7 @@ public:
         exec_label.setCharacterSize(16);
         exec_label.setFillColor(sf::Color::White);
         exec_label.setPosition(650, 130);
-        window.draw(exec_label);
+        target.draw(exec_label);
         
         // Draw processes
         sf::CircleShape process_shape(20);
@@ -633,14 +885,14 @@ public:
                 process_shape.setOutlineColor(sf::Color::White);
             }
             
-            window.draw(process_shape);
+            target.draw(process_shape);
             
             // Draw process ID
             stringstream process_stream;
             process_stream << "P" << process.pid;
             process_text.setString(process_stream.str());
             process_text.setPosition(process.position.x - 10, process.position.y - 8);
-            window.draw(process_text);
+            target.draw(process_text);
             
             // Draw remaining time
             if (!process.finished) {
@@ -652,12 +904,12 @@ public:
                 remaining_text.setFillColor(sf::Color::Yellow);
                 stringstream remaining_stream;
                 remaining_stream << process.remaining_time;
-                if (process.is_executing && sequence[current_executing_queue] == 3) {
+                if (process.is_executing && sequence[process.queue_index] == 3) {
                     remaining_stream << "/" << process.time_slice_remaining;
                 }
                 remaining_text.setString(remaining_stream.str());
                 remaining_text.setPosition(process.position.x - 5, process.position.y + 25);
-                window.draw(remaining_text);
+                target.draw(remaining_text);
             }
         }
         
@@ -688,12 +940,13 @@ public:
         }
         
         stats_text.setString(stats_stream.str());
-        window.draw(stats_text);
-        
-        window.display();
+        target.draw(stats_text);
     }
     
     void run() {
+        window.create(sf::VideoMode(1400, 900), "Multilevel Queue Scheduler Visualization");
+        window.setFramerateLimit(60);
+        
         while (window.isOpen()) {
             handleEvents();
             updateSimulation();
@@ -701,14 +954,158 @@ public:
             render();
         }
     }
+    
+    // Render every tick into an offscreen texture and write numbered PNGs
+    // (<prefix>_000000.png, ...). PNG encoding runs on worker threads while
+    // the next frame is drawn. Each tick gets frames_per_tick frames, animated
+    // as if the tick lasted 1 / animation_speed seconds.
+    // Returns false if a frame or the requested export could not be written.
+    bool runOffscreen(const string& prefix, int frames_per_tick) {
+        sf::RenderTexture texture;
+        if (!texture.create(1400, 900)) {
+            cout << "Error: Could not create offscreen render texture\n";
+            return false;
+        }
+        
+        frames_per_tick = max(1, frames_per_tick);
+        float frame_dt = 1.0f / (animation_speed * frames_per_tick);
+        
+        FrameWriter writer;
+        int frame = 0;
+        
+        simulation_running = true;
+        
+        auto emitFrames = [&](int count) {
+            for (int i = 0; i < count; i++) {
+                advanceAnimations(frame_dt);
+                draw(texture);
+                texture.display();
+                
+                char number[16];
+                snprintf(number, sizeof(number), "_%06d.png", frame++);
+                unique_ptr<sf::Image> image(new sf::Image(texture.getTexture().copyToImage()));
+                writer.push(std::move(image), prefix + number);
+            }
+        };
+        
+        emitFrames(1);
+        while (!simulation_completed) {
+            stepSimulation();
+            emitFrames(frames_per_tick);
+        }
+        
+        writer.finish();
+        cout << "Wrote " << frame << " frames to " << prefix << "_*.png";
+        if (writer.failures() > 0) {
+            cout << " (" << writer.failures() << " failed)";
+        }
+        cout << "\n";
+        return writer.failures() == 0 && !export_failed;
+    }
+    
+    // Run the whole simulation without a window or tick delay.
+    // Returns false if the requested export could not be written.
+    bool runHeadless() {
+        headless = true;
+        simulation_running = true;
+        scheduler.run();
+        
+        for (auto& process : processes) {
+            syncProcess(process);
+        }
+        current_time = scheduler.currentTime();
+        
+        simulation_completed = true;
+        calculateFinalStatistics();
+        return !export_failed;
+    }
 };
 
-int main() {
+void printUsage(const char* program) {
+    cout << "Usage: " << program << " [data file] [--headless] [--export csv|jsonl] [--export-file path]\n"
+         << "       [--record prefix] [--frames-per-tick n] [--speed ticks_per_second]\n";
+}
+
+int main(int argc, char* argv[]) {
     cout << "=== Multilevel Queue Scheduler Visualizer ===\n";
     
+    string data_file = "data.txt";
+    bool headless = false;
+    string record_prefix;
+    int frames_per_tick = 1;
+    float speed = 1.0f;
+    ResultExporter::Format export_format = ResultExporter::NONE;
+    string export_path;
+    
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--headless") {
+            headless = true;
+        } else if (arg == "--export" && i + 1 < argc) {
+            export_format = ResultExporter::parseFormat(argv[++i]);
+            if (export_format == ResultExporter::NONE) {
+                cout << "Error: Unknown export format: " << argv[i] << " (use csv or jsonl)\n";
+                return 1;
+            }
+        } else if (arg == "--export-file" && i + 1 < argc) {
+            export_path = argv[++i];
+        } else if (arg == "--record" && i + 1 < argc) {
+            record_prefix = argv[++i];
+        } else if (arg == "--frames-per-tick" && i + 1 < argc) {
+            char* end;
+            long value = strtol(argv[++i], &end, 10);
+            if (*end != '\0' || end == argv[i] || value < 1 || value > INT_MAX) {
+                cout << "Error: --frames-per-tick needs a positive integer, got: " << argv[i] << "\n";
+                printUsage(argv[0]);
+                return 1;
+            }
+            frames_per_tick = (int)value;
+        } else if (arg == "--speed" && i + 1 < argc) {
+            char* end;
+            double value = strtod(argv[++i], &end);
+            if (*end != '\0' || end == argv[i] || !(value > 0)) {
+                cout << "Error: --speed needs a positive number, got: " << argv[i] << "\n";
+                printUsage(argv[0]);
+                return 1;
+            }
+            speed = (float)value;
+        } else if (arg[0] != '-') {
+            data_file = arg;
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    
+    if (headless && !record_prefix.empty()) {
+        cout << "Error: --record and --headless cannot be combined (--record already runs without a window)\n";
+        printUsage(argv[0]);
+        return 1;
+    }
+    
+    if (export_format != ResultExporter::NONE && export_path.empty()) {
+        export_path = ResultExporter::defaultPath(export_format);
+    }
+    
     MLQVisualizer visualizer;
-    visualizer.loadFromFile("data.txt");
-    visualizer.run();
+    visualizer.setExport(export_format, export_path);
+    visualizer.setDataFile(data_file);
+    if (!visualizer.loadFromFile(data_file)) {
+        return 1;
+    }
+    
+    if (!record_prefix.empty()) {
+        visualizer.setSpeed(speed);
+        if (!visualizer.runOffscreen(record_prefix, frames_per_tick)) {
+            return 1;
+        }
+    } else if (headless) {
+        if (!visualizer.runHeadless()) {
+            return 1;
+        }
+    } else {
+        visualizer.run();
+    }
 
     return 0;
 }